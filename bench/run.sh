@@ -0,0 +1,39 @@
+#!/bin/bash
+# SPDX-License-Identifier: MIT
+#
+# Usage: ../../bench/run.sh <path to benchmark cases>   (run from zmk/app)
+#
+# Builds each case that has a native_posix_64.keymap, runs it and prints one
+# key=value line per case so results can be diffed between runs. Every mock
+# press except a held &mo should produce one keycode press; a shortfall or a
+# nonzero error count means events were dropped.
+
+if [ -z "$1" ]; then
+    echo "Usage: $0 <path to benchmark cases>"
+    exit 1
+fi
+
+status=0
+for case in $(find "$1" -name native_posix_64.keymap -exec dirname \{\} \; | sort); do
+    name=$(basename "$case")
+    build="build/bench/$name"
+
+    if ! west build -d "$build" -b native_posix_64 -- -DZMK_CONFIG="$(pwd)/$case" > /dev/null 2>&1; then
+        echo "case=$name build=failed"
+        status=1
+        continue
+    fi
+
+    start=$(date +%s%N)
+    "./$build/zephyr/zmk.exe" | sed -e "s/.*> //" > "$build/bench.log"
+    end=$(date +%s%N)
+
+    echo "case=$name" \
+        "mock_presses=$(grep -o 'ZMK_MOCK_PRESS' "$case/native_posix_64.keymap" | wc -l)" \
+        "elapsed_us=$(( (end - start) / 1000 ))" \
+        "pressed=$(grep -c 'hid_listener_keycode_pressed' "$build/bench.log")" \
+        "released=$(grep -c 'hid_listener_keycode_released' "$build/bench.log")" \
+        "errors=$(grep -c '<err>' "$build/bench.log")"
+done
+
+exit $status
@@ -0,0 +1,16 @@
+/*
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+
+#include <lvgl.h>
+#include <zephyr/kernel.h>
+
+struct zmk_widget_link_quality {
+    sys_snode_t node;
+    lv_obj_t *obj;
+};
+
+int zmk_widget_link_quality_init(struct zmk_widget_link_quality *widget, lv_obj_t *parent);
+lv_obj_t *zmk_widget_link_quality_obj(struct zmk_widget_link_quality *widget);
@@ -0,0 +1,217 @@
+/*
+ * SPDX-License-Identifier: MIT
+ */
+
+#include <stdio.h>
+
+#include <zephyr/kernel.h>
+#include <zephyr/bluetooth/conn.h>
+#include <zephyr/bluetooth/hci.h>
+#include <zephyr/sys/byteorder.h>
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_DECLARE(zmk, CONFIG_ZMK_LOG_LEVEL);
+
+#include <zmk/activity.h>
+#include <zmk/ble.h>
+#include <zmk/display.h>
+#include <zmk/event_manager.h>
+#include <zmk/events/activity_state_changed.h>
+
+#include <lily58/display/widgets/link_quality.h>
+
+/* HCI reports 127 when RSSI or TX power is not available */
+#define LINK_QUALITY_UNAVAILABLE INT8_MAX
+
+static sys_slist_t widgets = SYS_SLIST_STATIC_INIT(&widgets);
+
+struct link_quality_state {
+    bool connected;
+    uint16_t interval; /* units of 1.25 ms */
+    int8_t rssi;
+    int8_t tx_power;
+};
+
+static struct link_quality_state last_state;
+
+static bool link_quality_state_equal(const struct link_quality_state *a,
+                                     const struct link_quality_state *b) {
+    return a->connected == b->connected && a->interval == b->interval && a->rssi == b->rssi &&
+           a->tx_power == b->tx_power;
+}
+
+#if IS_ENABLED(CONFIG_ZMK_SPLIT) && !IS_ENABLED(CONFIG_ZMK_SPLIT_ROLE_CENTRAL)
+static void find_first_conn(struct bt_conn *conn, void *data) {
+    struct bt_conn **found = data;
+
+    if (*found == NULL) {
+        *found = bt_conn_ref(conn);
+    }
+}
+#endif
+
+/* The host link on the central, the split link on the peripheral */
+static struct bt_conn *link_quality_conn(void) {
+#if IS_ENABLED(CONFIG_ZMK_SPLIT) && !IS_ENABLED(CONFIG_ZMK_SPLIT_ROLE_CENTRAL)
+    struct bt_conn *conn = NULL;
+
+    bt_conn_foreach(BT_CONN_TYPE_LE, find_first_conn, &conn);
+    return conn;
+#else
+    if (!zmk_ble_active_profile_is_connected()) {
+        return NULL;
+    }
+
+    return bt_conn_lookup_addr_le(BT_ID_DEFAULT, zmk_ble_active_profile_addr());
+#endif
+}
+
+static int read_rssi(uint16_t handle, int8_t *rssi) {
+    struct bt_hci_cp_read_rssi *cp;
+    struct net_buf *buf, *rsp = NULL;
+    int err;
+
+    buf = bt_hci_cmd_create(BT_HCI_OP_READ_RSSI, sizeof(*cp));
+    if (buf == NULL) {
+        return -ENOBUFS;
+    }
+
+    cp = net_buf_add(buf, sizeof(*cp));
+    cp->handle = sys_cpu_to_le16(handle);
+
+    err = bt_hci_cmd_send_sync(BT_HCI_OP_READ_RSSI, buf, &rsp);
+    if (err < 0) {
+        return err;
+    }
+
+    *rssi = ((struct bt_hci_rp_read_rssi *)rsp->data)->rssi;
+    net_buf_unref(rsp);
+    return 0;
+}
+
+static int read_tx_power(uint16_t handle, int8_t *tx_power) {
+    struct bt_hci_cp_read_tx_power_level *cp;
+    struct net_buf *buf, *rsp = NULL;
+    int err;
+
+    buf = bt_hci_cmd_create(BT_HCI_OP_READ_TX_POWER_LEVEL, sizeof(*cp));
+    if (buf == NULL) {
+        return -ENOBUFS;
+    }
+
+    cp = net_buf_add(buf, sizeof(*cp));
+    cp->handle = sys_cpu_to_le16(handle);
+    cp->type = 0; /* current level */
+
+    err = bt_hci_cmd_send_sync(BT_HCI_OP_READ_TX_POWER_LEVEL, buf, &rsp);
+    if (err < 0) {
+        return err;
+    }
+
+    *tx_power = ((struct bt_hci_rp_read_tx_power_level *)rsp->data)->tx_power_level;
+    net_buf_unref(rsp);
+    return 0;
+}
+
+static struct link_quality_state link_quality_get_state(void) {
+    struct link_quality_state state = {
+        .connected = false,
+        .interval = 0,
+        .rssi = LINK_QUALITY_UNAVAILABLE,
+        .tx_power = LINK_QUALITY_UNAVAILABLE,
+    };
+    struct bt_conn *conn = link_quality_conn();
+    struct bt_conn_info info;
+    uint16_t handle;
+
+    if (conn == NULL) {
+        return state;
+    }
+
+    if (bt_conn_get_info(conn, &info) == 0 && info.state == BT_CONN_STATE_CONNECTED &&
+        bt_hci_get_conn_handle(conn, &handle) == 0) {
+        state.connected = true;
+        state.interval = info.le.interval;
+
+        if (read_rssi(handle, &state.rssi) < 0) {
+            state.rssi = LINK_QUALITY_UNAVAILABLE;
+        }
+        if (read_tx_power(handle, &state.tx_power) < 0) {
+            state.tx_power = LINK_QUALITY_UNAVAILABLE;
+        }
+    }
+
+    bt_conn_unref(conn);
+    return state;
+}
+
+static void set_label(lv_obj_t *label, const struct link_quality_state *state) {
+    char text[32];
+    int len;
+
+    if (!state->connected) {
+        lv_label_set_text(label, "--");
+        return;
+    }
+
+    /* 1.25 ms units, shown to one decimal place */
+    len = snprintf(text, sizeof(text), "%u.%ums", state->interval * 5 / 4,
+                   (state->interval * 5 % 4) * 25 / 10);
+
+    if (state->rssi != LINK_QUALITY_UNAVAILABLE) {
+        len += snprintf(text + len, sizeof(text) - len, " %ddBm", state->rssi);
+    }
+    if (state->tx_power != LINK_QUALITY_UNAVAILABLE) {
+        snprintf(text + len, sizeof(text) - len, " TX%+d", state->tx_power);
+    }
+
+    lv_label_set_text(label, text);
+}
+
+static void link_quality_update(struct k_work *work);
+static K_WORK_DELAYABLE_DEFINE(link_quality_work, link_quality_update);
+
+/* Runs on the display work queue, so LVGL calls are safe here */
+static void link_quality_update(struct k_work *work) {
+    struct link_quality_state state = link_quality_get_state();
+    struct zmk_widget_link_quality *widget;
+
+    if (!link_quality_state_equal(&state, &last_state)) {
+        last_state = state;
+        SYS_SLIST_FOR_EACH_CONTAINER(&widgets, widget, node) { set_label(widget->obj, &state); }
+    }
+
+    /* Stop polling while idle; the activity listener restarts it */
+    if (zmk_activity_get_state() == ZMK_ACTIVITY_ACTIVE) {
+        k_work_schedule_for_queue(zmk_display_work_q(), &link_quality_work,
+                                  K_MSEC(CONFIG_LILY58_WIDGET_LINK_QUALITY_REFRESH_MS));
+    }
+}
+
+static int link_quality_listener(const zmk_event_t *eh) {
+    const struct zmk_activity_state_changed *ev = as_zmk_activity_state_changed(eh);
+
+    if (ev != NULL && ev->state == ZMK_ACTIVITY_ACTIVE) {
+        k_work_schedule_for_queue(zmk_display_work_q(), &link_quality_work, K_NO_WAIT);
+    }
+
+    return ZMK_EV_EVENT_BUBBLE;
+}
+
+ZMK_LISTENER(widget_link_quality, link_quality_listener);
+ZMK_SUBSCRIPTION(widget_link_quality, zmk_activity_state_changed);
+
+int zmk_widget_link_quality_init(struct zmk_widget_link_quality *widget, lv_obj_t *parent) {
+    widget->obj = lv_label_create(parent);
+
+    set_label(widget->obj, &last_state);
+    sys_slist_append(&widgets, &widget->node);
+
+    k_work_schedule_for_queue(zmk_display_work_q(), &link_quality_work, K_NO_WAIT);
+
+    return 0;
+}
+
+lv_obj_t *zmk_widget_link_quality_obj(struct zmk_widget_link_quality *widget) {
+    return widget->obj;
+}